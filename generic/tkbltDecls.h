@@ -67,6 +67,25 @@ TKBLT_STORAGE_CLASS void		Blt_InstallIndexProc(Tcl_Interp*interp,
 TKBLT_STORAGE_CLASS double		Blt_VecMin(Blt_Vector *vPtr);
 /* 19 */
 TKBLT_STORAGE_CLASS double		Blt_VecMax(Blt_Vector *vPtr);
+/* 20 */
+TKBLT_STORAGE_CLASS int		Blt_VectorAppend(Blt_Vector *vecPtr,
+				const double *values, int n);
+/* 21 */
+TKBLT_STORAGE_CLASS int		Blt_VectorWriteRange(Blt_Vector *vecPtr, int first,
+				const double *values, int n);
+/* 22 */
+TKBLT_STORAGE_CLASS int		Blt_VectorNotifyRange(Blt_Vector *vecPtr, int first,
+				int last);
+/* 23 */
+TKBLT_STORAGE_CLASS void		Blt_GetVectorDirtyRange(Blt_Vector *vecPtr,
+				int *firstPtr, int *lastPtr);
+/* 24 */
+TKBLT_STORAGE_CLASS int		Blt_VectorReadRange(Blt_Vector *vecPtr, int first,
+				double *values, int n);
+/* 25 */
+TKBLT_STORAGE_CLASS int		Blt_PeekVectorById(Tcl_Interp*interp,
+				Blt_VectorId clientId,
+				Blt_Vector **vecPtrPtr);
 
 typedef struct TkbltStubs {
     int magic;
@@ -92,6 +111,12 @@ typedef struct TkbltStubs {
     void (*blt_InstallIndexProc) (Tcl_Interp*interp, const char *indexName, Blt_VectorIndexProc *procPtr); /* 17 */
     double (*blt_VecMin) (Blt_Vector *vPtr); /* 18 */
     double (*blt_VecMax) (Blt_Vector *vPtr); /* 19 */
+    int (*blt_VectorAppend) (Blt_Vector *vecPtr, const double *values, int n); /* 20 */
+    int (*blt_VectorWriteRange) (Blt_Vector *vecPtr, int first, const double *values, int n); /* 21 */
+    int (*blt_VectorNotifyRange) (Blt_Vector *vecPtr, int first, int last); /* 22 */
+    void (*blt_GetVectorDirtyRange) (Blt_Vector *vecPtr, int *firstPtr, int *lastPtr); /* 23 */
+    int (*blt_VectorReadRange) (Blt_Vector *vecPtr, int first, double *values, int n); /* 24 */
+    int (*blt_PeekVectorById) (Tcl_Interp*interp, Blt_VectorId clientId, Blt_Vector **vecPtrPtr); /* 25 */
 } TkbltStubs;
 
 extern const TkbltStubs *tkbltStubsPtr;
@@ -146,6 +171,18 @@ extern const TkbltStubs *tkbltStubsPtr;
 	(tkbltStubsPtr->blt_VecMin) /* 18 */
 #define Blt_VecMax \
 	(tkbltStubsPtr->blt_VecMax) /* 19 */
+#define Blt_VectorAppend \
+	(tkbltStubsPtr->blt_VectorAppend) /* 20 */
+#define Blt_VectorWriteRange \
+	(tkbltStubsPtr->blt_VectorWriteRange) /* 21 */
+#define Blt_VectorNotifyRange \
+	(tkbltStubsPtr->blt_VectorNotifyRange) /* 22 */
+#define Blt_GetVectorDirtyRange \
+	(tkbltStubsPtr->blt_GetVectorDirtyRange) /* 23 */
+#define Blt_VectorReadRange \
+	(tkbltStubsPtr->blt_VectorReadRange) /* 24 */
+#define Blt_PeekVectorById \
+	(tkbltStubsPtr->blt_PeekVectorById) /* 25 */
 
 #endif /* defined(USE_TKBLT_STUBS) */
 
@@ -76,6 +76,16 @@ namespace Blt {
     double scale;
   } AxisRange;
 
+  // Coefficients of hMap/vMap, for mapping many values at once
+  typedef struct {
+    double min;
+    double scale;
+    double range;
+    double screenMin;
+    int logScale;
+    int flip;
+  } AxisTransform;
+
   class TickLabel {
   public:
     Point2d anchorPos;
@@ -260,6 +270,7 @@ namespace Blt {
     double invVMap(double y);
     double hMap(double x);
     double vMap(double y);
+    void getTransform(AxisTransform*, int);
   };
 };
 
@@ -69,6 +69,7 @@ namespace Blt {
     virtual ~ElemValues();
 
     void reset();
+    void findRange();
     int nValues() {return nValues_;}
     double min() {return min_;}
     double max() {return max_;}
@@ -80,8 +81,6 @@ namespace Blt {
     ElemValuesSource(int);
     ElemValuesSource(int, double*);
     ~ElemValuesSource();
-
-    void findRange();
   };
 
   class ElemValuesVector : public ElemValues
@@ -96,6 +95,7 @@ namespace Blt {
 
     int getVector();
     int fetchValues(Blt_Vector*);
+    int updateValues(Blt_Vector*);
     void freeSource();
   };
 
@@ -151,6 +151,8 @@ namespace Blt {
 
     double xRange_;
     double yRange_;
+    MapArena arena_;
+    MapArena scratch_;
 
   public:
     Graph* graphPtr_;
@@ -162,12 +164,17 @@ namespace Blt {
     int* activeIndices_;
     int active_;		
     int labelActive_;
+    unsigned int flags_;
+    unsigned int dataVersion_;
+    Region2d exts_;
 
     ChainLink* link;
 
   protected:
     double FindElemValuesMinimum(ElemValues*, double);
-    PenStyle** StyleMap();
+    PenStyle** StyleMap(int**);
+    int* sortByStyle(int*, int*, int, int, int*);
+    MapArena* unmergedArena();
 
   public:
     Element(Graph*, const char*, Tcl_HashEntry*);
@@ -85,6 +85,8 @@ namespace Blt {
   } BarElementOptions;
 
   class BarElement : public Element {
+    friend class BarGraph;
+
   protected:
     BarPen* builtinPenPtr;
     int* barToData_;
@@ -93,15 +95,19 @@ namespace Blt {
     Rectangle* activeRects_;
     int nBars_;
     int nActive_;
+    GridIndex* barIndex_;
     GraphSegments xeb_;
     GraphSegments yeb_;
+    int* groupIndex_;
+    int nGroupIndex_;
 
   protected:
     void ResetStylePalette(Chain*);
     void checkStacks(Axis*, Axis*, double*, double*);
-    void mergePens(BarStyle**);
+    void mergePens(int*);
     void mapActive();
     void reset();
+    void indexBars();
     void mapErrorBars(BarStyle**);
     void drawSegments(Drawable, BarPen*, Rectangle*, int);
     void drawValues(Drawable, BarPen*, Rectangle*, int, int*);
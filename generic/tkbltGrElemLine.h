@@ -37,6 +37,7 @@
 #include "tkbltGrPenLine.h"
 
 namespace Blt {
+  class Spline;
 
   typedef struct {
     Point2d *screenPts;
@@ -54,6 +55,7 @@ namespace Blt {
   typedef struct {
     int start;
     GraphPoints screenPts;
+    XPoint* xPoints;
   } bltTrace;
 
   typedef struct {
@@ -87,6 +89,7 @@ namespace Blt {
     LinePen *activePenPtr;
     LinePen *normalPenPtr;
     LinePenOptions builtinPen;
+    Tcl_Obj* reduceObjPtr;
 
     // derived
     Tk_3DBorder fillBg;
@@ -95,12 +98,17 @@ namespace Blt {
     int scaleSymbols;
     int reqSmooth;
     int penDir;
+    int aggregate;
+    int render;
+    int reduceMethod;
   } LineElementOptions;
 
   class LineElement : public Element {
   public:
     enum PenDirection {INCREASING, DECREASING, BOTH_DIRECTIONS};
     enum Smoothing {LINEAR, STEP, CUBIC, QUADRATIC, CATROM};
+    enum Aggregate {AGGREGATE_AUTO, AGGREGATE_OFF, AGGREGATE_ON};
+    enum Render {RENDER_SYMBOLS, RENDER_DENSITY};
 
   protected:
     LinePen* builtinPenPtr;
@@ -113,7 +121,23 @@ namespace Blt {
     GraphSegments yeb_;
     int symbolInterval_;
     int symbolCounter_;
-    Chain* traces_;
+    bltTrace* traces_;
+    int nTraces_;
+    int tracesSize_;
+    unsigned int* density_;
+    int densityX_;
+    int densityY_;
+    int densityWidth_;
+    int densityHeight_;
+    unsigned int densityMax_;
+    GridIndex* pointIndex_;
+    GridIndex* traceIndex_;
+    bltTrace** indexTraces_;
+    int* indexFirst_;
+    int nIndexTraces_;
+    Spline* spline_;
+    unsigned int splineVersion_;
+    int splineKey_;
 
     void drawCircle(Display*, Drawable, LinePen*, int, Point2d*, int);
     void drawSquare(Display*, Drawable, LinePen*, int, Point2d*, int);
@@ -121,42 +145,50 @@ namespace Blt {
     void drawCross(Display*, Drawable, LinePen*, int, Point2d*, int);
     void drawDiamond(Display*, Drawable, LinePen*, int, Point2d*, int);
     void drawArrow(Display*, Drawable, LinePen*, int, Point2d*, int);
+    void drawSymbolShapes(Drawable, LinePen*, int, int, Point2d*);
+    SymbolSprite* makeSprite(LinePen*, int);
+    int stampSymbols(Drawable, LinePen*, int, int, Point2d*);
 
   protected:
     int scaleSymbol(int);
     void getScreenPoints(MapInfo*);
     void reducePoints(MapInfo*, double);
+    int useAggregate(MapInfo*);
+    void aggregatePoints(MapInfo*);
     void generateSteps(MapInfo*);
     void generateSpline(MapInfo*);
     void generateParametricSpline(MapInfo*);
     void mapSymbols(MapInfo*);
     void mapActiveSymbols();
-    void mergePens(LineStyle**);
+    void mergePens(int*);
     int outCode(Region2d*, Point2d*);
     int clipSegment(Region2d*, int, int, Point2d*, Point2d*);
     void saveTrace(int, int, MapInfo*);
-    void freeTraces();
     void mapTraces(MapInfo*);
     void mapFillArea(MapInfo*);
     void mapErrorBars(LineStyle**);
+    void mapDensity();
+    void getDensityColors(LinePen*, XColor**);
+    int densityLevel(unsigned int);
     void reset();
+    void indexPoints();
+    void indexTraces();
+    void freeIndexes();
     int closestTrace();
     void closestPoint(ClosestSearch*);
     void drawSymbols(Drawable, LinePen*, int, int, Point2d*);
     void drawTraces(Drawable, LinePen*);
     void drawValues(Drawable, LinePen*, int, Point2d*, int*);
+    void drawDensity(Drawable, LinePen*);
     void setLineAttributes(PSOutput*, LinePen*);
     void printTraces(PSOutput*, LinePen*);
     void printValues(PSOutput*, LinePen*, int, Point2d*, int*);
     void printSymbols(PSOutput*, LinePen*, int, int, Point2d*);
+    void printDensity(PSOutput*, LinePen*);
     double distanceToLine(int, int, Point2d*, Point2d*, Point2d*);
     double distanceToX(int, int, Point2d*, Point2d*, Point2d*);
     double distanceToY(int, int, Point2d*, Point2d*, Point2d*);
-    int simplify(Point2d*, int, int, double, int*);
-    double findSplit(Point2d*, int, int, int*);
 
-    int naturalSpline(Point2d*, int, Point2d*, int);
-    int quadraticSpline(Point2d*, int, Point2d*, int);
     int naturalParametricSpline(Point2d*, int, Region2d*, int, Point2d*, int);
     int catromParametricSpline(Point2d*, int, Point2d*, int);
 
@@ -56,7 +56,12 @@ namespace Blt {
 
     int visible_;
     GC gc_;
-    Point segArr_[4];
+    XSegment segArr_[2];
+    int drawn_;
+    XSegment drawnArr_[2];
+    int drawnWidth_;
+
+    void erase();
 
   public:
     Crosshairs(Graph*);
@@ -65,6 +70,7 @@ namespace Blt {
     int configure();
     void map();
     void draw(Drawable);
+    void update();
 
     void on();
     void off();
@@ -89,6 +89,7 @@ namespace Blt {
     virtual void map() =0;
     virtual int pointIn(Point2d*) =0;
     virtual int regionIn(Region2d*, int) =0;
+    virtual int bounds(Region2d*) =0;
     virtual void print(PSOutput*) =0;
 
     virtual ClassId classId() =0;
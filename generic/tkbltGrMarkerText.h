@@ -67,6 +67,7 @@ namespace Blt {
     void map();
     int pointIn(Point2d*);
     int regionIn(Region2d*, int);
+    int bounds(Region2d*);
     void print(PSOutput*);
 
   public:
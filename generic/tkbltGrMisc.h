@@ -55,6 +55,11 @@ using namespace std;
 #define LAYOUT          (1<<6)
 #define	MAP_MARKERS     (1<<7)
 #define	CACHE           (1<<8)
+#define	MAP_ELEMENTS    (1<<9)
+#define	UPDATE_EXTENTS  (1<<10)
+#define	CACHE_ELEMENTS  (1<<11)
+#define	CACHE_ACTIVE    (1<<12)
+#define	FRAME           (1<<13)
 
 #define MARGIN_NONE	-1
 #define MARGIN_BOTTOM	0		/* x */
@@ -104,6 +109,58 @@ namespace Blt {
     int offset;
   } Dashes;
 
+#define INDEX_CELL_SIZE 16
+
+  typedef void (GridBoxProc)(ClientData, int, Region2d*);
+
+  // A uniform grid over a screen region, each cell listing the items whose
+  // bounding boxes overlap it.  Items outside the region are kept in the
+  // border cells, and items covering many cells in a separate list.
+  class GridIndex {
+  protected:
+    double left_;
+    double top_;
+    int cellSize_;
+    int nCols_;
+    int nRows_;
+    int* first_;
+    int* items_;
+    int* wide_;
+    int nWide_;
+
+    void cellRange(Region2d*, int*, int*, int*, int*);
+
+  public:
+    GridIndex(Region2d*, int, int, GridBoxProc*, ClientData);
+    virtual ~GridIndex();
+
+    int* search(Region2d*, int*);
+  };
+
+  typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t size;
+    size_t used;
+  } ArenaBlock;
+
+  // Memory for the geometry an item computes when it is mapped, all of
+  // which is dropped when it is next mapped.  Allocating just moves along a
+  // block.  Resetting drops everything at once but keeps the memory, merged
+  // into one block big enough for the last map, for the next map.
+  class MapArena {
+  protected:
+    ArenaBlock* blocks_;
+    size_t want_;
+
+  public:
+    MapArena();
+    virtual ~MapArena();
+
+    void* alloc(size_t);
+    void reset();
+    void release();
+  };
+
   extern char* dupstr(const char*);
   extern Graph* getGraphFromWindowData(Tk_Window tkwin);
 
@@ -62,6 +62,7 @@ namespace Blt {
     void printSegments(Segment2d*, int);
     void printRectangle(double, double, int, int);
     void printPolygon(Point2d*, int);
+    void printImageMask(double, double, int, int, unsigned char*);
     void print3DRectangle(Tk_3DBorder, double, double, int, int, int, int);
 
     void fillRectangle(double, double, int, int);
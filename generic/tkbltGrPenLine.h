@@ -49,6 +49,22 @@ namespace Blt {
     GC fillGC;
   } Symbol;
 
+#define PEN_SPRITES 4	// symbol sizes cached by a pen
+
+  // A symbol drawn once into a pixmap, with a clip mask of the pixels it
+  // covers, so that it can be stamped with XCopyArea.
+  typedef struct {
+    Pixmap pixmap;
+    Pixmap mask;
+    GC gc;
+    SymbolType type;
+    int size;
+    int width;
+    int height;
+    int x;		/* Symbol center within the pixmap */
+    int y;
+  } SymbolSprite;
+
   typedef struct {
     int errorBarShow;
     int errorBarLineWidth;
@@ -69,6 +85,8 @@ namespace Blt {
   public:
     GC traceGC_;
     GC errorBarGC_;
+    SymbolSprite sprites_[PEN_SPRITES];
+    int nextSprite_;
 
   public:
     LinePen(Graph*, const char*, Tcl_HashEntry*);
@@ -80,6 +98,8 @@ namespace Blt {
     const char* typeName() {return "line";}
 
     int configure();
+    void freeSprite(SymbolSprite*);
+    void freeSprites();
   };
 };
 
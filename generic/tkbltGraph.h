@@ -90,6 +90,13 @@ namespace Blt {
     Tcl_HashTable tagTable;
   } Component;
 
+  typedef struct {
+    int x;
+    int y;
+    ClientData item;
+    ClassId classId;
+  } PickEntry;
+
 #define rightMargin	margins[MARGIN_RIGHT]
 #define leftMargin	margins[MARGIN_LEFT]
 #define topMargin	margins[MARGIN_TOP]
@@ -167,13 +174,37 @@ namespace Blt {
     double vScale_;
     double hScale_;
     Pixmap cache_;
+    Pixmap backCache_;
+    Pixmap elemCache_;
+    Pixmap frame_;
+    Region2d damage_;
     int cacheWidth_;
     int cacheHeight_;
+    unsigned int mapGeneration_;
+    int mapThreads_;
+    unsigned int pickGeneration_;
+    PickEntry* pickCache_;
+    GridIndex* markerIndex_;
+    Marker** indexMarkers_;
+    int nIndexMarkers_;
+    Axis** indexAxes_;
+    Region2d* axisBoxes_;
+    int nIndexAxes_;
 
   protected:
     void layoutGraph();
+    void freeCache();
+    void freePick();
+    void updatePick();
+    void indexMarkers();
+    void indexAxes();
+    ClientData pickNearest(int, int, ClassId*);
   
     void drawMargins(Drawable);
+    void drawBackground(Drawable);
+    void drawRaisedLegend(Drawable);
+    void drawBorder(Drawable);
+    void drawFrame(Region2d*);
     void printMargins(PSOutput*);
     int getMarginGeometry(Margin*);
 
@@ -182,6 +213,8 @@ namespace Blt {
     void destroyElements();
     void configureElements();
     virtual void mapElements();
+    void mapChangedElements();
+    void mapElementList(Element**, int);
     void drawElements(Drawable);
     void drawActiveElements(Drawable);
     void printElements(PSOutput*);
@@ -190,7 +223,7 @@ namespace Blt {
     void destroyMarkers();
     void configureMarkers();
     void mapMarkers();
-    void drawMarkers(Drawable, int);
+    void drawMarkers(Drawable, int, Region2d*);
     void printMarkers(PSOutput*, int);
 
     int createAxes();
@@ -201,6 +234,8 @@ namespace Blt {
     void drawAxesLimits(Drawable);
     void drawAxesGrids(Drawable);
     void adjustAxes();
+    void scaleAxes();
+    virtual void rescaleAxes();
 
   public:
     Graph(ClientData, Tcl_Interp*, int, Tcl_Obj* const []);
@@ -210,7 +245,10 @@ namespace Blt {
     void map();
     void draw();
     void eventuallyRedraw();
+    int restoreFrame(int, int, int, int);
+    void damage(Region2d*);
     int print(const char*, PSOutput*);
+    int snapshot(Tk_PhotoHandle, int, int);
     void extents(Region2d*);
     int invoke(const Ensemble*, int, int, Tcl_Obj* const []);
     void reconfigure();
@@ -224,6 +262,7 @@ namespace Blt {
     Point2d map2D(double, double, Axis*, Axis*);
     Point2d invMap2D(double, double, Axis*, Axis*);
     virtual void resetAxes();
+    void updateAxes();
     Axis* nearestAxis(int, int);
 
     ClientData markerTag(const char*);
@@ -245,7 +284,9 @@ namespace Blt {
     const char** getTags(ClientData, ClassId, int*);
     ClientData pickEntry(int, int, ClassId*);
 
+    int maxRequestItems(int);
     void drawSegments(Drawable, GC, Segment2d*, int);
+    void drawSegments(Drawable, GC, XSegment*, int);
     void setDashes(GC, Dashes*);
 
     GC getPrivateGC(unsigned long, XGCValues*);
@@ -36,12 +36,6 @@
 
 namespace Blt {
 
-  typedef struct {
-    double value;
-    Axis* xAxis;
-    Axis* yAxis;
-  } BarSetKey;
-
   class BarGroup {
   public:
     int nSegments;
@@ -95,11 +89,11 @@ namespace Blt {
   public:
     BarGroup* barGroups_;
     int nBarGroups_;
-    Tcl_HashTable setTable_;
     int maxBarSetSize_;
 
   protected:
     void resetAxes();
+    void rescaleAxes();
     void mapElements();
     void initBarSets();
     void destroyBarSets();
@@ -0,0 +1,82 @@
+/*
+ * Smithsonian Astrophysical Observatory, Cambridge, MA, USA
+ * This code has been modified under the terms listed below and is made
+ * available under the same terms.
+ */
+
+/*
+ *	Copyright 1995-2004 George A Howlett.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining
+ *	a copy of this software and associated documentation files (the
+ *	"Software"), to deal in the Software without restriction, including
+ *	without limitation the rights to use, copy, modify, merge, publish,
+ *	distribute, sublicense, and/or sell copies of the Software, and to
+ *	permit persons to whom the Software is furnished to do so, subject to
+ *	the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be
+ *	included in all copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *	EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *	MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *	NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *	LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *	OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __BltSimplify_h__
+#define __BltSimplify_h__
+
+namespace Blt {
+
+  // Reduces a polyline, given as interleaved x,y pairs, to the points that
+  // keep it within a tolerance of the original.  The first and last points
+  // are always kept and the indices returned are in increasing order.
+  //
+  // DOUGLAS_PEUCKER keeps every point further than the tolerance from the
+  // simplified line.  The farthest point of a range is found from a tree of
+  // convex hulls over blocks of points rather than by scanning the range,
+  // and large lines split their independent sub-ranges across threads, at
+  // most maxThreads of them if it is set.
+  // VISVALINGAM_WHYATT drops points in order of the area of the triangle
+  // they make with their neighbours, while it is below the tolerance
+  // squared.
+  class Simplify {
+  public:
+    enum Method {DOUGLAS_PEUCKER, VISVALINGAM_WHYATT};
+
+  protected:
+    Method method_;
+    int maxThreads_;
+    const double* xy_;
+    int nPoints_;
+    int nLeaves_;
+    int** hulls_;
+    int* nHulls_;
+
+  protected:
+    void buildTree();
+    void freeTree();
+    void makeHull(const int*, int, int**, int*, int*, char*);
+    void scanRange(int, int, double, double, double, double*, int*);
+    void scanHull(int, double, double, double, double*, int*);
+    int reduceArea(double, int*);
+    int reduceRanges(double, int*);
+
+  public:
+    Simplify(Method);
+    virtual ~Simplify();
+
+    int reduce(const double*, int, double, int*);
+    double findSplit(int, int, int*);
+    int reduceRange(int, int, double, int*);
+
+    Method method() {return method_;}
+    void setMaxThreads(int nn) {maxThreads_ = nn;}
+  };
+};
+
+#endif
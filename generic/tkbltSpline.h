@@ -0,0 +1,69 @@
+/*
+ * Smithsonian Astrophysical Observatory, Cambridge, MA, USA
+ * This code has been modified under the terms listed below and is made
+ * available under the same terms.
+ */
+
+/*
+ *	Copyright 2009 George A Howlett.
+ *
+ *	Permission is hereby granted, free of charge, to any person obtaining
+ *	a copy of this software and associated documentation files (the
+ *	"Software"), to deal in the Software without restriction, including
+ *	without limitation the rights to use, copy, modify, merge, publish,
+ *	distribute, sublicense, and/or sell copies of the Software, and to
+ *	permit persons to whom the Software is furnished to do so, subject to
+ *	the following conditions:
+ *
+ *	The above copyright notice and this permission notice shall be
+ *	included in all copies or substantial portions of the Software.
+ *
+ *	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *	EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *	MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *	NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *	LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *	OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __BltSpline_h__
+#define __BltSpline_h__
+
+namespace Blt {
+
+  // Interpolating function y = f(x) through a set of knots, fitted once in
+  // data space and evaluated at arbitrary abscissas.  Lookups keep a hint
+  // to the last interval used so that sorted queries cost O(1) each.
+  class Spline {
+  public:
+    enum Method {LINEAR, CUBIC, QUADRATIC, CATROM};
+
+  protected:
+    Method method_;
+    int nKnots_;
+    double* x_;
+    double* y_;
+    double* coeffs_;
+    int* cases_;
+    int hint_;
+
+  protected:
+    void reset();
+    int locate(double);
+
+  public:
+    Spline(Method);
+    virtual ~Spline();
+
+    int fit(const double*, const double*, int);
+    double eval(double);
+    void eval(const double*, double*, int);
+
+    Method method() {return method_;}
+    int nKnots() {return nKnots_;}
+  };
+};
+
+#endif
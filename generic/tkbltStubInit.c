@@ -25,6 +25,12 @@ const TkbltStubs tkbltStubs = {
     Blt_InstallIndexProc, /* 17 */
     Blt_VecMin, /* 18 */
     Blt_VecMax, /* 19 */
+    Blt_VectorAppend, /* 20 */
+    Blt_VectorWriteRange, /* 21 */
+    Blt_VectorNotifyRange, /* 22 */
+    Blt_GetVectorDirtyRange, /* 23 */
+    Blt_VectorReadRange, /* 24 */
+    Blt_PeekVectorById, /* 25 */
 };
 
 /* !END!: Do not edit above this line. */
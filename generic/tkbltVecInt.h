@@ -46,6 +46,10 @@
 
 #define SPECIAL_INDEX		-2
 
+#define RANDOM_UNIFORM		0
+#define RANDOM_NORMAL		1
+#define RANDOM_EXPONENTIAL	2
+
 #define FFT_NO_CONSTANT		(1<<0)
 #define FFT_BARTLETT		(1<<1)
 #define FFT_SPECTRUM		(1<<2)
@@ -71,6 +75,17 @@
 					 * Update the min and max limits when
 					 * they are needed */
 
+#define RANGE_CACHED		(1<<10)	/* The min and max fields hold the
+					 * limits of the whole vector. */
+
+#define EXPOSED			(1<<11)	/* The value array was handed to a C
+					 * client that can't release it. A
+					 * compressed vector keeps its working
+					 * copy from then on. */
+
+#define IsExposed(vPtr) \
+  (((vPtr)->notifyFlags & EXPOSED) || ((vPtr)->nExposed > 0))
+
 #define FindRange(array, first, last, min, max) \
   {						\
     min = max = 0.0;				\
@@ -88,6 +103,8 @@
   }
 
 namespace Blt {
+  class Spline;
+  struct VectorStore;
 
   typedef struct {
     double x;
@@ -100,6 +117,15 @@ namespace Blt {
     Tcl_HashTable indexProcTable;
     Tcl_Interp* interp;
     unsigned int nextId;
+    void *interpXPtr;		/* Abscissas and ordinates of the last */
+    void *interpYPtr;		/* interpolation, and their dirty counts */
+    int interpXDirty, interpYDirty; /* when its spline was fitted. */
+    Spline *interpSpline;
+    Tcl_WideUInt randomSeed;	/* Seed and position of the stream used */
+    Tcl_WideUInt randomCounter;	/* by unseeded random fills. */
+    unsigned int epoch;		/* Bumped whenever a vector or index proc
+				 * is created or destroyed. Validates the
+				 * lookups cached in Tcl_Objs. */
   } VectorInterpData;
 
   typedef struct {
@@ -145,6 +171,14 @@ namespace Blt {
     int flush;
     int first, last;		/* Selected region of vector. This is used
 				 * mostly for the math routines */
+    int dirtyFirst, dirtyLast;	/* Range of values changed since clients
+				 * were last notified. */
+    int notifyFirst, notifyLast; /* Range of values reported by the current
+				 * (or last) notification. */
+    VectorStore *storePtr;	/* If non-NULL, the values are kept in
+				 * compressed chunks. See tkbltVecCompress.C */
+    int nExposed;		/* Number of vector ids whose clients hold
+				 * the value array. */
   } Vector;
 
   extern const char* Itoa(int value);
@@ -154,6 +188,12 @@ namespace Blt {
   extern int  Vec_GetIndexRange(Tcl_Interp* interp, Vector *vPtr, 
 				const char *string, int flags,
 				Blt_VectorIndexProc **procPtrPtr);
+  extern int  Vec_GetIndexFromObj(Tcl_Interp* interp, Vector *vPtr, 
+				  Tcl_Obj *objPtr, int *indexPtr, int flags, 
+				  Blt_VectorIndexProc **procPtrPtr);
+  extern int  Vec_GetIndexRangeFromObj(Tcl_Interp* interp, Vector *vPtr, 
+				       Tcl_Obj *objPtr, int flags,
+				       Blt_VectorIndexProc **procPtrPtr);
   extern Vector* Vec_ParseElement(Tcl_Interp* interp, VectorInterpData *dataPtr,
 				  const char *start, const char **endPtr, 
 				  int flags);
@@ -162,8 +202,26 @@ namespace Blt {
   extern void Vec_FlushCache(Vector *vPtr);
   extern void Vec_UpdateRange(Vector *vPtr);
   extern void Vec_UpdateClients(Vector *vPtr);
+  extern void Vec_NotifyRange(Vector *vPtr, int first, int last);
   extern void Vec_Free(Vector *vPtr);
   extern Vector* Vec_New(VectorInterpData *dataPtr);
+  extern void Vec_FreeInterpCache(VectorInterpData *dataPtr);
+  extern int Vec_Compress(Tcl_Interp* interp, Vector *vPtr, int chunkSize);
+  extern int Vec_Uncompress(Tcl_Interp* interp, Vector *vPtr);
+  extern void Vec_FreeStore(Vector *vPtr);
+  extern int Vec_IsDeflated(Vector *vPtr);
+  extern int Vec_Inflate(Tcl_Interp* interp, Vector *vPtr);
+  extern void Vec_Deflate(Vector *vPtr);
+  extern void Vec_StoreChanged(Vector *vPtr, int first);
+  extern void Vec_StoreAdopt(Vector *vPtr);
+  extern void Vec_StoreRelease(Vector *vPtr);
+  extern int Vec_StoreWrite(Vector *vPtr, int first, const double *values,
+			    int n);
+  extern void Vec_StoreInfo(Vector *vPtr, int *nChunksPtr, size_t *nBytesPtr);
+  extern void Vec_GetValues(Vector *vPtr, int first, int last,
+			    double *values);
+  extern void Vec_GetLimits(Vector *vPtr, int first, int last,
+			    double *minPtr, double *maxPtr);
   extern int Vec_MapVariable(Tcl_Interp* interp, Vector *vPtr, 
 			     const char *name);
   extern int Vec_ChangeLength(Tcl_Interp* interp, Vector *vPtr, int length);
@@ -172,6 +230,8 @@ namespace Blt {
 			    int *newPtr);
   extern int Vec_LookupName(VectorInterpData *dataPtr, const char *vecName,
 			    Vector **vPtrPtr);
+  extern int Vec_LookupObj(VectorInterpData *dataPtr, Tcl_Obj *objPtr,
+			   Vector **vPtrPtr);
   extern VectorInterpData* Vec_GetInterpData (Tcl_Interp* interp);
   extern int Vec_Reset(Vector *vPtr, double *dataArr, int nValues,
 		       int arraySize, Tcl_FreeProc *freeProc);
@@ -183,6 +243,9 @@ namespace Blt {
 				Vector *srcPtr);
   extern int Vec_Duplicate(Vector *destPtr, Vector *srcPtr);
   extern size_t *Vec_SortMap(Vector **vectors, int nVectors);
+  extern void Vec_RandomFill(double *values, int nValues, int dist,
+			     double param1, double param2,
+			     Tcl_WideUInt seed, Tcl_WideUInt counter);
   extern double Vec_Max(Vector *vecObjPtr);
   extern double Vec_Min(Vector *vecObjPtr);
   extern int ExprVector(Tcl_Interp* interp, char *string, Blt_Vector *vector);
@@ -196,7 +259,3 @@ namespace Blt {
 
 extern Tcl_IdleProc Blt_Vec_NotifyClients;
 
-#ifdef _WIN32
-double drand48(void);
-void srand48(long int seed);
-#endif
@@ -131,6 +131,18 @@ extern "C" {
 				   Blt_VectorIndexProc * procPtr);
   TKBLT_STORAGE_CLASS double Blt_VecMin(Blt_Vector *vPtr);
   TKBLT_STORAGE_CLASS double Blt_VecMax(Blt_Vector *vPtr);
+  TKBLT_STORAGE_CLASS int Blt_VectorAppend(Blt_Vector *vecPtr, const double *values,
+			      int n);
+  TKBLT_STORAGE_CLASS int Blt_VectorWriteRange(Blt_Vector *vecPtr, int first,
+				  const double *values, int n);
+  TKBLT_STORAGE_CLASS int Blt_VectorNotifyRange(Blt_Vector *vecPtr, int first,
+				   int last);
+  TKBLT_STORAGE_CLASS void Blt_GetVectorDirtyRange(Blt_Vector *vecPtr, int *firstPtr,
+				      int *lastPtr);
+  TKBLT_STORAGE_CLASS int Blt_VectorReadRange(Blt_Vector *vecPtr, int first,
+				 double *values, int n);
+  TKBLT_STORAGE_CLASS int Blt_PeekVectorById(Tcl_Interp* interp, Blt_VectorId clientId,
+				Blt_Vector **vecPtrPtr);
 #ifdef __cplusplus
 }
 #endif
@@ -8,4 +8,5 @@ source axis.tcl
 source legend.tcl
 source crosshairs.tcl
 source markers.tcl
+source vector.tcl
 
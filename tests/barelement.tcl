@@ -69,6 +69,12 @@ bltTest3 $bltgr element data2 -yerror {5 5 5 5 5 5 5 5 5 5 5} $dops
 #bltTest3 $bltgr element data2 -yhigh $dops
 #bltTest3 $bltgr element data2 -ylow $dops
 
+bltCmd $bltgr element configure data3 -xdata {2.0 1.8 1.6 1.4 1.2 1.0 0.8 0.6 0.4 0.2}
+bltTest $bltgr -barmode stacked $dops
+bltTest $bltgr -barmode aligned $dops
+bltTest $bltgr -barmode overlap $dops
+bltCmd $bltgr element configure data3 -xdata xv
+
 bltCmd $bltgr element activate data2
 bltCmd $bltgr element deactivate data2
 #bltCmd $bltgr element bind data1 <Button-1> [list puts "%x %y"]
@@ -85,6 +85,14 @@ proc bltCmd {graph args} {
 #    read stdin 1
 }
 
+proc bltCheck {expected args} {
+    puts stderr " $args"
+    set result [uplevel #0 $args]
+    if {$result ne $expected} {
+	puts stderr "  failed: expected \"$expected\", got \"$result\""
+    }
+}
+
 proc bltElements {graph} {
     blt::vector create xv(10)
     blt::vector create yv(10)
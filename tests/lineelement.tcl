@@ -11,6 +11,8 @@ $bltgr element activate data3
 puts stderr "Testing Line Element.."
 
 bltTest3 $bltgr element data3 -activepen foo $dops
+bltTest3 $bltgr element data2 -aggregate on $dops
+bltTest3 $bltgr element data2 -aggregate off $dops
 bltTest3 $bltgr element data2 -areabackground yellow $dops
 bltTest3 $bltgr element data2 -bindtags {aa}
 bltTest3 $bltgr element data2 -color yellow $dops
@@ -32,7 +34,10 @@ bltTest3 $bltgr element data1 -outline green $dops
 bltTest3 $bltgr element data1 -outlinewidth 5 $dops
 bltTest3 $bltgr element data2 -pen foo $dops
 bltTest3 $bltgr element data1 -pixels 20 $dops
-#bltTest3 $bltgr element data2 -reduce $dops
+bltTest3 $bltgr element data1 -render density $dops
+bltTest3 $bltgr element data2 -reduce 20 $dops
+bltTest3 $bltgr element data2 -reduce 5m $dops
+bltTest3 $bltgr element data2 -reducemethod visvalingam $dops
 bltTest3 $bltgr element data1 -scalesymbols no $dops
 bltTest3 $bltgr element data2 -showerrorbars no $dops
 bltTest3 $bltgr element data1 -showvalues none $dops
@@ -42,6 +47,11 @@ bltTest3 $bltgr element data1 -smooth linear $dops
 bltTest3 $bltgr element data1 -smooth cubic $dops
 bltTest3 $bltgr element data1 -smooth quadratic $dops
 bltTest3 $bltgr element data1 -smooth catrom $dops
+bltCmd $bltgr element configure data3 -smooth cubic
+bltTest3 $bltgr element data3 -ydata {35 30 25 20 15 15 10 10 5 0} $dops
+bltCmd $bltgr element configure data3 -smooth quadratic
+bltTest3 $bltgr element data3 -ydata {35 30 25 20 15 15 10 10 5 0} $dops
+bltCmd $bltgr element configure data3 -smooth linear
 #bltTest3 $bltgr element data2 -styles $dops
 bltTest3 $bltgr element data1 -symbol arrow $dops
 bltTest3 $bltgr element data1 -symbol cross $dops
@@ -81,6 +91,11 @@ bltCmd $bltgr element activate data2
 bltCmd $bltgr element deactivate data2
 #bltCmd $bltgr element bind data1 <Button-1> [list puts "%x %y"]
 bltCmd $bltgr element cget data1 -smooth
+bltCmd $bltgr element configure data2 -reduce 2m
+bltCheck 2m $bltgr element cget data2 -reduce
+bltCheck 1 catch {$bltgr element configure data2 -reduce 4 -smooth bogus}
+bltCheck 2m $bltgr element cget data2 -reduce
+bltCmd $bltgr element configure data2 -reduce 0
 bltCmd $bltgr element configure data1
 bltCmd $bltgr element configure data1 -smooth
 #bltCmd $bltgr element closest 50 50
@@ -88,6 +103,17 @@ bltCmd $bltgr element configure data1 -smooth
 bltCmd $bltgr element create data4
 bltCmd $bltgr element create data5
 bltCmd $bltgr element delete data4 data5
+blt::vector create cx cy
+cx seq 0.2 2.0 1000
+cy expr {cx * 40}
+cx compress on
+cy compress on
+bltCmd $bltgr element create data4 -xdata cx -ydata cy
+update idletasks
+bltCheck 1 expr {[dict get [cx compress info] ratio] > 1}
+bltCheck 1 expr {[dict get [cy compress info] ratio] > 1}
+bltCmd $bltgr element delete data4
+blt::vector destroy cx cy
 bltCmd $bltgr element exists data1
 bltCmd $bltgr element lower data1
 bltCmd $bltgr element lower data2 data3
@@ -50,6 +50,22 @@ bltTest $bltgr -width 300 $dops
 bltTest $bltgr -plotwidth 300 $dops
 bltTest $bltgr -plotheight 300 $dops
 
+set picked 0
+$bltgr element bind all <Enter> {set picked 1}
+lassign [$bltgr transform 1.0 55] x y
+set x [expr {int($x)}]
+set y [expr {int($y) - 25}]
+event generate $bltgr <Motion> -x $x -y $y
+update
+bltCheck 0 set picked
+$bltgr configure -searchhalo 40
+event generate $bltgr <Motion> -x 1 -y 1
+event generate $bltgr <Motion> -x $x -y $y
+update
+bltCheck 1 set picked
+$bltgr configure -searchhalo 2m
+$bltgr element bind all <Enter> {}
+
 ##bltCmd $bltgr axis
 bltCmd $bltgr cget -background
 bltCmd $bltgr configure 
@@ -64,6 +80,8 @@ bltCmd $bltgr configure -background cyan
 ##bltCmd $bltgr marker
 ##bltCmd $bltgr pen
 #bltCmd $bltgr postscript output foo.ps
+bltCmd $bltgr snapshot -file foo.png
+bltCmd $bltgr snapshot -file foo.ppm -format ppm -width 300 -height 200
 #bltCmd $bltgr transform
 ##bltCmd $bltgr x2axis
 ##bltCmd $bltgr xaxis
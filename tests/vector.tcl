@@ -0,0 +1,81 @@
+source base.tcl
+
+puts stderr "Testing Vector..."
+
+blt::vector create vx vy vat vout
+vx set {1 2 3 4 5}
+vy set {2 4 6 8 10}
+vat set {1.5 2.5 3.5 4.5}
+
+bltCheck {3.0 5.0 7.0 9.0} vx interpolate vy -at vat
+bltCheck {3.0 5.0 7.0 9.0} vx interpolate vy -at vat -method cubic
+bltCheck {3.0 5.0 7.0 9.0} vx interpolate vy -at vat -method quadratic
+bltCheck {3.0 5.0 7.0 9.0} vx interpolate vy -at vat -method catrom
+bltCheck {} vx interpolate vy -at vat -out vout
+bltCheck {3.0 5.0 7.0 9.0} vout values
+bltCheck 1 catch {vx interpolate vy -out vnew -method bogus}
+bltCheck 1 catch {vx interpolate vy -out vnew}
+bltCheck {} info commands vnew
+vy set {2 4 6 8}
+bltCheck 1 catch {vx interpolate vy -at vat}
+vy set {2 4 6 8 10}
+vx set {5 4 3 2 1}
+bltCheck 1 catch {vx interpolate vy -at vat -out vnew}
+bltCheck {} info commands vnew
+vx set {1 2 3 4 5}
+bltCheck {3.0 5.0 7.0 9.0} vx interpolate vy -at vat
+blt::vector destroy vx vy vat vout
+
+blt::vector create vr(1000)
+vr random -seed 42
+set values [vr values]
+vr random -seed 42
+bltCheck $values vr values
+vr random -seed 43
+bltCheck 0 expr {[vr values] eq $values}
+vr random -seed 7 -params {10 20}
+bltCheck 1 expr {[vr min] >= 10 && [vr max] < 20}
+vr random -seed 7 -dist normal -params {100 1}
+bltCheck 1 expr {abs([blt::vector expr mean(vr)] - 100) < 1}
+vr random -seed 7 -dist exponential -params 2
+bltCheck 1 expr {[vr min] >= 0}
+bltCheck 1 catch {vr random -dist bogus}
+blt::vector destroy vr
+
+blt::vector create vs
+bltCheck 1 catch {blt::vector expr {srandom(vs)}}
+vs set {1e30}
+bltCheck 1 catch {blt::vector expr {srandom(vs)}}
+vs set {42.5}
+bltCheck 42.5 blt::vector expr {srandom(vs)}
+blt::vector destroy vs
+
+blt::vector create vc
+vc compress on
+bltCheck {} vc values
+bltCheck 0 vc length
+vc compress off
+
+vc seq 1 5000 5000
+set values [vc values]
+vc compress on -chunksize 256
+bltCheck 5000 vc length
+bltCheck $values vc values
+bltCheck 1.0 vc min
+bltCheck 5000.0 vc max
+bltCheck {101.0 102.0 103.0} vc range 100 102
+vc append {5001 5002}
+bltCheck 5002 vc length
+bltCheck 5002.0 vc max
+bltCheck 20 dict get [vc compress info] chunks
+vc compress off
+bltCheck 5002 vc length
+bltCheck {5001.0 5002.0} vc range 5000 5001
+vc compress on
+set vc(0) 0
+bltCheck 1 expr {[dict get [vc compress info] ratio] < 1}
+update idletasks
+bltCheck 1 expr {[dict get [vc compress info] ratio] > 1}
+blt::vector destroy vc
+
+puts stderr "done"